@@ -0,0 +1,186 @@
+#!/usr/bin/env python2
+
+# Benchmark suite for the DOM solver, running the standalone driver (dom_host).
+# For every combination of radiation grid size, work decomposition, sweep
+# kernel, tiling, number of angles and extinction coefficient, solves the
+# radiation field once, and records the number of source iterations, the
+# wall-clock time of the solve, the iteration (full sweep) rate and the
+# cell-angle update rate. If --phases is given, the solver is also run with
+# per-phase timing enabled, and the time spent in each phase of the source
+# iteration is recorded (the phases are bracketed by execution fences, which
+# slows down the solve itself). The decompositions and kernels default to those
+# of the base configuration. Under angular decomposition, the tiling only
+# controls how many processors the angle groups are spread over.
+#
+# For correctness, the intensities computed under every decomposition, kernel
+# and tiling are checked against those of the first such combination (for the
+# same grid, angles and extinction coefficient). If --reference is given, they
+# are also checked against those of a previous run of this script (from the
+# same directory layout), so results can be tracked across code changes. The
+# results are written as CSV or JSON, and the script exits with an error if any
+# check failed.
+
+import argparse
+import collections
+import csv
+import itertools
+import json
+import os
+import subprocess
+import sys
+
+PHASES = ['source_term', 'cache_intensity', 'bound', 'sweep',
+          'reduce_intensity', 'accelerate']
+
+def triple(s):
+    toks = s.split('x')
+    if len(toks) != 3:
+        raise argparse.ArgumentTypeError('Expected NxNxN, got %s' % s)
+    return [int(t) for t in toks]
+
+parser = argparse.ArgumentParser()
+parser.add_argument('base_json', type=argparse.FileType('r'))
+parser.add_argument('-g', '--grids', type=triple, nargs='+',
+                    default=[[16,16,16], [32,32,32], [64,64,64]])
+parser.add_argument('-t', '--tilings', type=triple, nargs='+',
+                    default=[[1,1,1], [2,2,2]])
+parser.add_argument('-d', '--decompositions', nargs='+')
+parser.add_argument('-k', '--kernels', nargs='+')
+parser.add_argument('-a', '--angles', type=int, nargs='+',
+                    default=[14, 86, 350])
+parser.add_argument('-s', '--sigmas', type=float, nargs='+',
+                    default=[0.5, 5.0, 50.0])
+parser.add_argument('-T', '--temperature', type=float, default=1000.0)
+parser.add_argument('-p', '--phases', action='store_true')
+parser.add_argument('-r', '--reference')
+parser.add_argument('-f', '--format', choices=['csv', 'json'], default='csv')
+parser.add_argument('-o', '--output', type=argparse.FileType('w'),
+                    default=sys.stdout)
+args = parser.parse_args()
+
+base = json.load(args.base_json)
+if base['Radiation']['type'] != 'DOM':
+    print >> sys.stderr, 'Base configuration must use the DOM radiation model'
+    sys.exit(1)
+decompositions = args.decompositions or [base['Radiation']['decomposition']]
+kernels = args.kernels or [base['Radiation']['sweepKernel']]
+
+def fmt(xyz):
+    return 'x'.join(str(n) for n in xyz)
+
+def last_row(stats_file):
+    with open(stats_file) as fin:
+        next(fin)
+        rows = [line.split('\t') for line in fin]
+    return rows[-1]
+
+def phase_times(phases_file):
+    times = {}
+    with open(phases_file) as fin:
+        next(fin)
+        for line in fin:
+            toks = line.split('\t')
+            times[toks[1]] = int(toks[2])
+    return times
+
+def check(run_dir, ref_dir):
+    if ref_dir is None:
+        return None
+    ref_file = os.path.join(ref_dir, 'intensity.dat')
+    if not os.path.exists(ref_file):
+        return None
+    ret = subprocess.call(
+        [os.path.join(os.environ['SOLEIL_DIR'], 'scripts',
+                      'compare_dom_intensity.py'),
+         os.path.join(run_dir, 'intensity.dat'), ref_file],
+        stdout=sys.stderr)
+    return ret == 0
+
+results = []
+for grid in args.grids:
+    for angles in args.angles:
+        for sigma in args.sigmas:
+            first_dir = None
+            for (decomposition, kernel, tiles) in itertools.product(
+                    decompositions, kernels, args.tilings):
+                config = json.loads(json.dumps(base))
+                config['Radiation']['xNum'] = grid[0]
+                config['Radiation']['yNum'] = grid[1]
+                config['Radiation']['zNum'] = grid[2]
+                config['Radiation']['angles'] = angles
+                config['Radiation']['decomposition'] = decomposition
+                config['Radiation']['sweepKernel'] = kernel
+                config['Mapping']['tiles'] = tiles
+                config['Mapping']['tilesPerRank'] = tiles
+                run_dir = 'dom_%s_%s_%s_%s_%d_%g' % (fmt(grid), decomposition,
+                                                     kernel, fmt(tiles),
+                                                     angles, sigma)
+                if not os.path.exists(run_dir):
+                    os.makedirs(run_dir)
+                for f in ['dom.txt', 'dom_phases.txt', 'dom_memory.txt']:
+                    if os.path.exists(os.path.join(run_dir, f)):
+                        os.remove(os.path.join(run_dir, f))
+                with open(os.path.join(run_dir, 'config.json'), 'w') as fout:
+                    json.dump(config, fout, indent=4)
+                env = dict(os.environ)
+                env['TIME_PHASES'] = '1' if args.phases else '0'
+                subprocess.check_call(
+                    [os.path.join(os.environ['SOLEIL_DIR'], 'src',
+                                  'dom_host.sh'),
+                     'config.json',
+                     '-temperature', str(args.temperature),
+                     '-sigma', str(sigma)],
+                    cwd=run_dir, env=env)
+                with open(os.path.join(run_dir, 'solve_time.dat')) as fin:
+                    micros = int(fin.read())
+                stats = last_row(os.path.join(run_dir, 'dom.txt'))
+                iterations = int(stats[1])
+                cells = grid[0] * grid[1] * grid[2]
+                res = {
+                    'grid': fmt(grid),
+                    'decomposition': decomposition,
+                    'kernel': kernel,
+                    'tiles': fmt(tiles),
+                    'angles': angles,
+                    'sigma': sigma,
+                    'iterations': iterations,
+                    'residual': float(stats[2]),
+                    'solve_time_us': micros,
+                    'sweeps_per_s': iterations / (micros / 1e6),
+                    'cell_angles_per_s':
+                        iterations * cells * angles / (micros / 1e6),
+                    'consistency_check': check(run_dir, first_dir),
+                    'reference_check': check(run_dir, None if
+                        args.reference is None else
+                        os.path.join(args.reference, run_dir)),
+                }
+                if args.phases:
+                    times = phase_times(os.path.join(run_dir,
+                                                     'dom_phases.txt'))
+                    for phase in PHASES:
+                        res[phase + '_us'] = times.get(phase)
+                results.append(res)
+                if first_dir is None:
+                    first_dir = run_dir
+
+columns = ['grid', 'decomposition', 'kernel', 'tiles', 'angles', 'sigma', 'iterations', 'residual',
+           'solve_time_us', 'sweeps_per_s', 'cell_angles_per_s']
+if args.phases:
+    columns += [phase + '_us' for phase in PHASES]
+columns += ['consistency_check', 'reference_check']
+if args.format == 'json':
+    json.dump([collections.OrderedDict((c, r[c]) for c in columns)
+               for r in results],
+              args.output, indent=4)
+    args.output.write('\n')
+else:
+    writer = csv.DictWriter(args.output, columns)
+    writer.writeheader()
+    for r in results:
+        writer.writerow(dict((c, '' if r[c] is None else r[c])
+                             for c in columns))
+
+if any(r['consistency_check'] is False or r['reference_check'] is False
+       for r in results):
+    print >> sys.stderr, 'Some intensity checks failed'
+    sys.exit(1)
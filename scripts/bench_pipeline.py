@@ -0,0 +1,57 @@
+#!/usr/bin/env python2
+
+# Benchmark pipelined execution of a coupled (2-section) simulation. For each
+# pipeline lag (0 meaning lockstep execution), runs a short simulation with
+# both sections using the same fixed time step, and reports the total
+# wall-clock time of the run, as well as the time per iteration, measured
+# from the second section's console output (which is the one finishing last).
+
+import argparse
+import json
+import os
+import sys
+import time
+
+import bench_util
+
+parser = argparse.ArgumentParser()
+parser.add_argument('base_json', type=argparse.FileType('r'))
+parser.add_argument('-l', '--lags', type=int, nargs='+',
+                    default=[0, 1, 2, 3])
+parser.add_argument('-t', '--delta_time', type=float, required=True)
+parser.add_argument('-i', '--iterations', type=int, default=100)
+args = parser.parse_args()
+
+base = json.load(args.base_json)
+if 'configs' not in base:
+    print 'Base configuration must describe a coupled simulation'
+    sys.exit(1)
+
+def time_per_iter(console_file):
+    # Skip the first iteration (warm-up)
+    with open(console_file) as fin:
+        next(fin)
+        rows = [line.split() for line in fin]
+    if len(rows) < 3:
+        return '-'
+    first = rows[1]
+    last = rows[-1]
+    iters = int(last[0]) - int(first[0])
+    wall = float(last[2]) - float(first[2])
+    return '%.3f' % (wall / iters)
+
+print 'Lag\tTotal Wall Time (s)\tWall Time per Iteration (s)'
+for lag in args.lags:
+    mc = bench_util.clone(base)
+    mc['pipelineLag'] = lag
+    for config in mc['configs']:
+        config['Integrator']['cfl'] = -1.0
+        config['Integrator']['fixedDeltaTime'] = args.delta_time
+        config['Integrator']['maxIter'] = args.iterations
+        config['IO']['wrtRestart'] = False
+    run_dir = 'pipeline_%d' % lag
+    start = time.time()
+    bench_util.run(mc, run_dir, flag='-m', time_phases=False)
+    total = time.time() - start
+    print '%d\t%.1f\t%s' % (lag, total, time_per_iter(
+        os.path.join(run_dir, 'sample1', 'console.txt')))
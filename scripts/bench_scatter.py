@@ -0,0 +1,50 @@
+#!/usr/bin/env python2
+
+# Benchmark the strategies for accumulating particle contributions onto the
+# fluid (and radiation) grid. Particles are placed using the 'Uniform' initial
+# distribution, which puts the same number of particles in every cell, so the
+# number of particles per cell directly controls how many updates hit the same
+# cell. For each combination of scatter mode and particles per cell, runs a
+# short simulation with per-phase timing enabled, then reports the average
+# time spent in the fluid ('scatter') and radiation ('radscatter') deposition
+# phases. The 'Sorted' mode is run with the particles re-sorted by cell on
+# every particle solve.
+
+import argparse
+import json
+
+import bench_util
+
+parser = argparse.ArgumentParser()
+parser.add_argument('base_json', type=argparse.FileType('r'))
+parser.add_argument('-m', '--modes', nargs='+',
+                    default=['Atomic', 'Privatized', 'Sorted'])
+parser.add_argument('-c', '--per_cell', type=int, nargs='+',
+                    default=[1, 8, 64])
+parser.add_argument('-i', '--iterations', type=int, default=20)
+args = parser.parse_args()
+
+base = json.load(args.base_json)
+num_cells = (int(base['Grid']['xNum']) *
+             int(base['Grid']['yNum']) *
+             int(base['Grid']['zNum']))
+parcel_size = int(base['Particles']['parcelSize'])
+
+print 'Mode\tPer Cell\tScatter Time (us)\tRadiation Scatter Time (us)'
+for mode in args.modes:
+    for per_cell in args.per_cell:
+        num = per_cell * num_cells * parcel_size
+        config = bench_util.clone(base)
+        config['Particles']['initCase'] = 'Uniform'
+        config['Particles']['initNum'] = num
+        config['Particles']['maxNum'] = num
+        config['Particles']['scatterMode'] = mode
+        config['Particles']['sortEvery'] = 1 if mode == 'Sorted' else 0
+        config['Integrator']['maxIter'] = args.iterations
+        config['IO']['wrtRestart'] = False
+        run_dir = 'scatter_%s_%d' % (mode, per_cell)
+        bench_util.run(config, run_dir)
+        times = bench_util.phases(run_dir)
+        print '%s\t%d\t%s\t%s' % (mode, per_cell,
+                                  bench_util.phase_average(times, 'scatter'),
+                                  bench_util.phase_average(times, 'radscatter'))
@@ -0,0 +1,59 @@
+#!/usr/bin/env python2
+
+# Benchmark periodic sorting of particles by cell. For each sorting frequency
+# (0 meaning no sorting), runs a short simulation with per-phase timing
+# enabled, then reports the average cost of a sort, and the average time spent
+# in the particle-grid kernels that benefit from the improved locality:
+# interpolation of fluid values to the particles (gather) and deposition of
+# particle forces onto the fluid (scatter). If --perf is given, the whole run
+# is also executed under 'perf stat', and the total cache misses are reported
+# (this only works for local runs).
+
+import argparse
+import json
+import os
+import sys
+
+import bench_util
+
+parser = argparse.ArgumentParser()
+parser.add_argument('base_json', type=argparse.FileType('r'))
+parser.add_argument('-s', '--sort_every', type=int, nargs='+',
+                    default=[0, 1, 10, 100])
+parser.add_argument('-i', '--iterations', type=int, default=200)
+parser.add_argument('--perf', action='store_true')
+args = parser.parse_args()
+
+base = json.load(args.base_json)
+if int(base['Particles']['maxNum']) == 0:
+    print 'Base configuration must include particles'
+    sys.exit(1)
+
+def cache_misses(perf_file):
+    with open(perf_file) as fin:
+        for line in fin:
+            toks = line.strip().split(',')
+            if len(toks) > 2 and toks[2] == 'cache-misses':
+                return toks[0]
+    return '-'
+
+print 'Sort Every\tSort Time (us)\tGather Time (us)\tScatter Time (us)\tCache Misses'
+for sort_every in args.sort_every:
+    config = bench_util.clone(base)
+    config['Particles']['sortEvery'] = sort_every
+    config['Integrator']['maxIter'] = args.iterations
+    config['IO']['wrtRestart'] = False
+    run_dir = 'sort_%d' % sort_every
+    wrapper = []
+    if args.perf:
+        wrapper = ['perf', 'stat', '-x', ',', '-o', 'perf.txt',
+                   '-e', 'cache-misses,cache-references', '--']
+    bench_util.run(config, run_dir, wrapper=wrapper)
+    times = bench_util.phases(run_dir)
+    misses = (cache_misses(os.path.join(run_dir, 'perf.txt'))
+              if args.perf else '-')
+    print '%d\t%s\t%s\t%s\t%s' % (sort_every,
+                                  bench_util.phase_average(times, 'sort'),
+                                  bench_util.phase_average(times, 'gather'),
+                                  bench_util.phase_average(times, 'scatter'),
+                                  misses)
@@ -0,0 +1,55 @@
+#!/usr/bin/env python2
+
+# Benchmark particle trading between tiles. For each combination of particle
+# count and (fixed) time step size, runs a short simulation with per-phase
+# timing enabled, then reports the average time spent trading against the
+# fraction of particles that changed tiles on each step. Larger time steps
+# make more particles cross tile boundaries.
+
+import argparse
+import json
+import sys
+
+import bench_util
+
+parser = argparse.ArgumentParser()
+parser.add_argument('base_json', type=argparse.FileType('r'))
+parser.add_argument('-n', '--particles', type=int, nargs='+',
+                    default=[10000, 100000, 1000000])
+parser.add_argument('-t', '--delta_times', type=float, nargs='+',
+                    default=[1e-4, 1e-3, 1e-2])
+parser.add_argument('-i', '--iterations', type=int, default=20)
+args = parser.parse_args()
+
+base = json.load(args.base_json)
+tiles = base['Mapping']['tiles']
+num_tiles = int(tiles[0]) * int(tiles[1]) * int(tiles[2])
+if num_tiles < 2:
+    print 'Base configuration must use more than one tile'
+    sys.exit(1)
+parcel_size = int(base['Particles']['parcelSize'])
+
+print 'Particles\tDelta Time\tMoved Fraction\tTrade Time (us)'
+for num in args.particles:
+    # Round the particle count down, to ensure an even initial distribution
+    num -= num % (num_tiles * parcel_size)
+    for dt in args.delta_times:
+        config = bench_util.clone(base)
+        config['Particles']['initNum'] = num
+        config['Particles']['maxNum'] = num
+        config['Integrator']['cfl'] = -1.0
+        config['Integrator']['fixedDeltaTime'] = dt
+        config['Integrator']['maxIter'] = args.iterations
+        config['IO']['wrtRestart'] = False
+        run_dir = 'trade_%d_%g' % (num, dt)
+        bench_util.run(config, run_dir)
+        # Average over all trading steps, except the first one (warm-up)
+        trades = bench_util.skip_warmup(
+            bench_util.phases(run_dir).get('trade', []))
+        if len(trades) == 0:
+            print '%d\t%g\t-\t-' % (num, dt)
+            continue
+        avg_time = sum(t for (t, _) in trades) / float(len(trades))
+        avg_moved = (sum(n for (_, n) in trades) / float(len(trades)) *
+                     parcel_size / num)
+        print '%d\t%g\t%.6f\t%.1f' % (num, dt, avg_moved, avg_time)
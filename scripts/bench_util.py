@@ -0,0 +1,54 @@
+# Shared helpers for the benchmark scripts. Each benchmark run gets its own
+# directory, holding the configuration it was run with and all the output of
+# the simulation.
+
+import json
+import os
+import subprocess
+
+def clone(config):
+    return json.loads(json.dumps(config))
+
+# Write 'config' into 'run_dir' (creating it if necessary), then run the
+# simulation there. 'flag' selects between a single-section ('-i') and a
+# multi-section ('-m') configuration. If 'time_phases' is set, per-phase
+# timing is enabled. 'wrapper' is prepended to the command line (e.g. to run
+# under a profiler).
+def run(config, run_dir, flag='-i', time_phases=True, wrapper=[]):
+    if not os.path.exists(run_dir):
+        os.makedirs(run_dir)
+    with open(os.path.join(run_dir, 'config.json'), 'w') as fout:
+        json.dump(config, fout, indent=4)
+    env = dict(os.environ)
+    if time_phases:
+        env['TIME_PHASES'] = '1'
+    subprocess.check_call(
+        wrapper +
+        [os.path.join(os.environ['SOLEIL_DIR'], 'src', 'soleil.sh'),
+         flag, 'config.json', '-o', '.'],
+        cwd=run_dir, env=env)
+
+# Read the per-phase timings of a run. Returns a map from phase name to the
+# list of (time in us, count) pairs, one per execution of the phase, in order.
+def phases(run_dir, sample=0):
+    res = {}
+    with open(os.path.join(run_dir, 'sample%d' % sample, 'phases.txt')) as fin:
+        next(fin)
+        for line in fin:
+            toks = line.split()
+            res.setdefault(toks[1], []).append((int(toks[2]), int(toks[3])))
+    return res
+
+# Drop the first sample (warm-up), if there are more.
+def skip_warmup(samples):
+    return samples[1:] if len(samples) > 1 else samples
+
+def average(times):
+    times = skip_warmup(times)
+    if len(times) == 0:
+        return '-'
+    return '%.1f' % (sum(times) / float(len(times)))
+
+# Average time of a phase, over all its executions except the first.
+def phase_average(times, phase):
+    return average([t for (t, _) in times.get(phase, [])])
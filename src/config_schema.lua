@@ -16,6 +16,10 @@ Exports.ParticlesBC = Enum('Periodic','Bounce','Disappear')
 Exports.ViscosityModel = Enum('Constant','PowerLaw','Sutherland')
 Exports.FlowInitCase = Enum('Uniform','Random','Restart','Perturbed','TaylorGreen2DVortex','TaylorGreen3DVortex')
 Exports.ParticlesInitCase = Enum('Random','Restart','Uniform')
+Exports.ParticlesScatterMode = Enum('Atomic','Privatized','Sorted')
+Exports.DOMSweepKernel = Enum('SubPoint','Cell')
+Exports.DOMAccelerator = Enum('OFF','Anderson')
+Exports.DOMDecomposition = Enum('Spatial','Angular')
 Exports.TempProfile = Union{
   Constant = {
     temperature = double,
@@ -68,6 +72,28 @@ Exports.RadiationModel = Union{
     zNum = int,
     -- number of quadrature points
     angles = int,
+    -- how to parallelize the sweep along each diagonal: over sub-points (one
+    -- per cell and angle), or over cells, vectorizing across each cell's angles
+    sweepKernel = Exports.DOMSweepKernel,
+    -- how to distribute the sweeps: over spatial tiles, with each angle group
+    -- pipelined through the tiles, or over angle groups, with each group
+    -- sweeping the whole grid (spread over the processors of the tiles)
+    decomposition = Exports.DOMDecomposition,
+    -- how to accelerate the convergence of source iteration
+    accelerator = Exports.DOMAccelerator,
+    -- test for convergence only after every this many iterations; the
+    -- iterations in between are issued without waiting on their residual, so
+    -- the runtime can run ahead (1 to test after every iteration)
+    residualCheckEvery = int,
+    -- recompute the radiation field only on the first RK stage of every this
+    -- many particle solves, reusing the last field in between (0 to recompute
+    -- it on every RK stage)
+    updateEvery = int,
+    -- also recompute it, on the first RK stage of a particle solve, whenever
+    -- the emission or absorption of some cell has changed by more than this
+    -- fraction since the last update (0 to disable); the check is a blocking
+    -- reduction, so it is only done once per particle solve
+    updateTolerance = double,
     -- wall emissivity [0.0-1.0]
     xHiEmiss = double,
     xLoEmiss = double,
@@ -197,8 +223,17 @@ Exports.Config = {
     collisions = bool,
     feeding = Exports.FeedModel,
     -- how many timesteps to advance the fluid before every particle solve
+    -- (the most it may advance, if adaptiveStagger is set)
     staggerFactor = int,
+    -- whether to pick the length of each particle solve from the particle
+    -- relaxation times
+    adaptiveStagger = bool,
     parcelSize = int,
+    -- sort particles by cell every this many particle solves (0 to disable)
+    sortEvery = int,
+    -- how to accumulate particle contributions onto the fluid and radiation
+    -- grids; 'Sorted' is meant to be combined with a non-zero sortEvery
+    scatterMode = Exports.ParticlesScatterMode,
   },
   Radiation = Exports.RadiationModel,
   IO = {
@@ -211,18 +246,30 @@ Exports.Config = {
   },
 }
 
--- Dual-section simulation config
+-- Multi-section simulation config: a chain of sections, each one feeding
+-- values into the next
 Exports.MultiConfig = {
-  -- case configurations for the two sections
-  configs = Array(2,Exports.Config),
-  -- volume to copy from every timestep (in the 1st section)
-  copySrc = Exports.Volume,
-  -- volume to copy into every timestep (in the 2nd section)
-  copyTgt = Exports.Volume,
-  -- whether to place the tiles of the two sections on the same set of ranks
+  -- case configurations for the sections, from upstream to downstream
+  configs = UpTo(3,Exports.Config),
+  -- volumes to copy from every timestep (the i-th one in the i-th section)
+  copySrc = UpTo(2,Exports.Volume),
+  -- volumes to copy into every timestep (the i-th one in the (i+1)-th section)
+  copyTgt = UpTo(2,Exports.Volume),
+  -- whether to place the tiles of all sections on the same set of ranks
   collocateSections = bool,
-  -- How often to copy values from one section to the other
+  -- How often to copy values from one section to the next
   copyEveryTimeSteps = int,
+  -- How many steps the first section may run ahead of the second (0 to run
+  -- them in lockstep); requires exactly two sections, both using the same
+  -- fixed time step
+  pipelineLag = int,
+  -- How many base time steps each section's time step spans (all 1 to advance
+  -- every section with the same time step); a section with a larger stable
+  -- time step can then take one step for every few steps of the others; every
+  -- copy into a section must fall at the start of a step of the section before
+  -- it (copyEveryTimeSteps and the receiver's startIter, each times the
+  -- receiver's ratio, must be multiples of the sender's)
+  stepRatios = UpTo(3,int),
 }
 
 return Exports
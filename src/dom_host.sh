@@ -9,6 +9,8 @@ export DEBUG="${DEBUG:-0}"
 export RANKS_PER_NODE=1
 export RESERVED_CORES="${RESERVED_CORES:-4}"
 export DEBUG_COPYING=0
+export TIME_PHASES="${TIME_PHASES:-0}"
+export REPORT_MEMORY=0
 
 export EXECUTABLE="$SOLEIL_DIR"/src/dom_host.exec
 export MINUTES=10
@@ -161,7 +161,7 @@ function run_sapling {
     source "$SOLEIL_DIR"/src/jobscript_shared.sh
     # Emit final command
     mpiexec -H "$NODES" --bind-to none \
-        -x LD_LIBRARY_PATH -x SOLEIL_DIR -x REALM_BACKTRACE -x LEGION_FREEZE_ON_ERROR -x DEBUG_COPYING \
+        -x LD_LIBRARY_PATH -x SOLEIL_DIR -x REALM_BACKTRACE -x LEGION_FREEZE_ON_ERROR -x DEBUG_COPYING -x TIME_PHASES -x REPORT_MEMORY \
         $COMMAND
     # Resources:
     # 40230MB RAM per node
@@ -31,6 +31,12 @@ export RESERVED_CORES="${RESERVED_CORES:-8}"
 # Whether to dump additional HDF files, for debugging cross-section copying
 export DEBUG_COPYING="${DEBUG_COPYING:-0}"
 
+# Whether to record per-phase wall-clock timings (serializes the main loop)
+export TIME_PHASES="${TIME_PHASES:-0}"
+
+# Whether to report particle and trade queue storage use
+export REPORT_MEMORY="${REPORT_MEMORY:-0}"
+
 ###############################################################################
 # Helper functions
 ###############################################################################
@@ -55,11 +61,11 @@ def numRanks(sample):
 f = json.load(open('$1'))
 if '$2' == 'single':
   print wallTime(f), numRanks(f)
-elif '$2' == 'dual':
-  print max(wallTime(f['configs'][0]), wallTime(f['configs'][1])), \
-        max(numRanks(f['configs'][0]), numRanks(f['configs'][1]))  \
-        if f['collocateSections'] else                             \
-        numRanks(f['configs'][0]) + numRanks(f['configs'][1])
+elif '$2' == 'multi':
+  print max(wallTime(c) for c in f['configs']),   \
+        max(numRanks(c) for c in f['configs'])    \
+        if f['collocateSections'] else            \
+        sum(numRanks(c) for c in f['configs'])
 else:
   assert(false)"
 }
@@ -84,7 +90,7 @@ for (( i = 1; i <= $#; i++ )); do
     if [[ "${!i}" == "-i" ]] && (( $i < $# )); then
         parse_config "${!j}" "single"
     elif [[ "${!i}" == "-m" ]] && (( $i < $# )); then
-        parse_config "${!j}" "dual"
+        parse_config "${!j}" "multi"
     fi
 done
 if (( NUM_RANKS < 1 )); then
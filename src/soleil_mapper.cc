@@ -315,17 +315,20 @@ public:
       } else if (EQUALS(args.argv[i], "-m") && i < args.argc-1) {
         MultiConfig mc;
         parse_MultiConfig(&mc, args.argv[i+1]);
-        process_config(mc.configs[0]);
-        unsigned num_ranks_0 = sample_mappings_.back().num_ranks();
-        if (!mc.collocateSections) {
-          reqd_ranks += num_ranks_0;
+        CHECK(mc.configs.length >= 2,
+              "Multi-section simulation needs at least 2 sections");
+        // Collocated sections all share the ranks of the largest one.
+        unsigned max_ranks = 0;
+        for (unsigned k = 0; k < mc.configs.length; ++k) {
+          process_config(mc.configs.values[k]);
+          unsigned num_ranks = sample_mappings_.back().num_ranks();
+          max_ranks = std::max(max_ranks, num_ranks);
+          if (!mc.collocateSections) {
+            reqd_ranks += num_ranks;
+          }
         }
-        process_config(mc.configs[1]);
-        unsigned num_ranks_1 = sample_mappings_.back().num_ranks();
         if (mc.collocateSections) {
-          reqd_ranks += std::max(num_ranks_0, num_ranks_1);
-        } else {
-          reqd_ranks += num_ranks_1;
+          reqd_ranks += max_ranks;
         }
       }
     }
@@ -363,7 +366,8 @@ private:
     // Tasks called on regions: read the SAMPLE_ID_TAG from the region
     if (task.is_index_space ||
         STARTS_WITH(task.get_task_name(), "sweep_") ||
-        EQUALS(task.get_task_name(), "cache_grid_translation") ||
+        STARTS_WITH(task.get_task_name(), "accumulate_intensity_") ||
+        EQUALS(task.get_task_name(), "cache_diagonals") ||
         EQUALS(task.get_task_name(), "initialize_angles") ||
         STARTS_WITH(task.get_task_name(), "readTileAttr")) {
       CHECK(!task.regions.empty(),
@@ -387,16 +391,19 @@ private:
       sample_ids.push_back(static_cast<unsigned>(config->Mapping.sampleId));
     }
     // Tasks with MultiConfig as 1st argument: read configs[*].Mapping.sampleId
-    else if (EQUALS(task.get_task_name(), "workDual")) {
+    else if (STARTS_WITH(task.get_task_name(), "workMulti")) {
       const MultiConfig* mc = static_cast<const MultiConfig*>(first_arg(task));
-      sample_ids.push_back
-        (static_cast<unsigned>(mc->configs[0].Mapping.sampleId));
-      sample_ids.push_back
-        (static_cast<unsigned>(mc->configs[1].Mapping.sampleId));
+      for (unsigned k = 0; k < mc->configs.length; ++k) {
+        sample_ids.push_back
+          (static_cast<unsigned>(mc->configs.values[k].Mapping.sampleId));
+      }
     }
     // Helper & I/O tasks: go up one level to the work task
     else if (STARTS_WITH(task.get_task_name(), "Console_Write") ||
              STARTS_WITH(task.get_task_name(), "Probe_Write") ||
+             STARTS_WITH(task.get_task_name(), "Memory_Write") ||
+             STARTS_WITH(task.get_task_name(), "Phases_Write") ||
+             STARTS_WITH(task.get_task_name(), "DOM_Write") ||
              EQUALS(task.get_task_name(), "IO_CreateDir") ||
              EQUALS(task.get_task_name(), "__dummy") ||
              STARTS_WITH(task.get_task_name(), "__unary_") ||
@@ -423,9 +430,21 @@ private:
 
   DomainPoint find_tile(const MapperContext ctx,
                         const Task& task) const {
+    // DOM tasks operating on the whole radiation grid (angular decomposition):
+    // spread the angle groups over the tiles, round-robin
+    if ((STARTS_WITH(task.get_task_name(), "sweep_") ||
+         STARTS_WITH(task.get_task_name(), "accumulate_intensity_")) &&
+        !is_tiled(ctx, task)) {
+      unsigned sample_id = find_sample_id(ctx, task);
+      const SampleMapping& mapping = sample_mappings_[sample_id];
+      unsigned idx = parse_angle_group(task) % mapping.num_tiles();
+      return Point<3>(idx / mapping.z_tiles() / mapping.y_tiles(),
+                      idx / mapping.z_tiles() % mapping.y_tiles(),
+                      idx % mapping.z_tiles());
+    }
     // 3D index space tasks that are launched individually
-    if (STARTS_WITH(task.get_task_name(), "sweep_") ||
-        STARTS_WITH(task.get_task_name(), "readTileAttr")) {
+    else if (STARTS_WITH(task.get_task_name(), "sweep_") ||
+             STARTS_WITH(task.get_task_name(), "readTileAttr")) {
       assert(!task.regions.empty() && task.regions[0].region.exists());
       DomainPoint tile =
         runtime->get_logical_region_color_point(ctx, task.regions[0].region);
@@ -433,11 +452,14 @@ private:
     }
     // Tasks that should run on the first rank of their sample's allocation
     else if (EQUALS(task.get_task_name(), "workSingle") ||
-             EQUALS(task.get_task_name(), "workDual") ||
-             EQUALS(task.get_task_name(), "cache_grid_translation") ||
+             STARTS_WITH(task.get_task_name(), "workMulti") ||
+             EQUALS(task.get_task_name(), "cache_diagonals") ||
              EQUALS(task.get_task_name(), "initialize_angles") ||
              STARTS_WITH(task.get_task_name(), "Console_Write") ||
              STARTS_WITH(task.get_task_name(), "Probe_Write") ||
+             STARTS_WITH(task.get_task_name(), "Memory_Write") ||
+             STARTS_WITH(task.get_task_name(), "Phases_Write") ||
+             STARTS_WITH(task.get_task_name(), "DOM_Write") ||
              EQUALS(task.get_task_name(), "IO_CreateDir") ||
              EQUALS(task.get_task_name(), "__dummy") ||
              STARTS_WITH(task.get_task_name(), "__unary_") ||
@@ -480,12 +502,16 @@ private:
     }
     // Sample-specific tasks that are launched individually
     else if (EQUALS(task.get_task_name(), "workSingle") ||
-             EQUALS(task.get_task_name(), "workDual") ||
+             STARTS_WITH(task.get_task_name(), "workMulti") ||
              STARTS_WITH(task.get_task_name(), "sweep_") ||
-             EQUALS(task.get_task_name(), "cache_grid_translation") ||
+             STARTS_WITH(task.get_task_name(), "accumulate_intensity_") ||
+             EQUALS(task.get_task_name(), "cache_diagonals") ||
              EQUALS(task.get_task_name(), "initialize_angles") ||
              STARTS_WITH(task.get_task_name(), "Console_Write") ||
              STARTS_WITH(task.get_task_name(), "Probe_Write") ||
+             STARTS_WITH(task.get_task_name(), "Memory_Write") ||
+             STARTS_WITH(task.get_task_name(), "Phases_Write") ||
+             STARTS_WITH(task.get_task_name(), "DOM_Write") ||
              EQUALS(task.get_task_name(), "IO_CreateDir") ||
              EQUALS(task.get_task_name(), "__dummy") ||
              STARTS_WITH(task.get_task_name(), "__unary_") ||
@@ -515,7 +541,7 @@ public:
     DefaultMapper::select_task_options(ctx, task, output);
     output.replicate =
       EQUALS(task.get_task_name(), "workSingle") ||
-      EQUALS(task.get_task_name(), "workDual");
+      STARTS_WITH(task.get_task_name(), "workMulti");
   }
 
   // Enable tracing.
@@ -533,8 +559,15 @@ public:
     // Work tasks: map to IO processors, so they don't get blocked by tiny
     // CPU tasks.
     if (EQUALS(task.get_task_name(), "workSingle") ||
-        EQUALS(task.get_task_name(), "workDual")) {
+        STARTS_WITH(task.get_task_name(), "workMulti")) {
+      ranking.push_back(Processor::IO_PROC);
+    }
+    // HDF dump tasks: also map to IO processors, so checkpoint writes drain in
+    // the background without taking CPUs away from time stepping.
+    else if (STARTS_WITH(task.get_task_name(), "dumpTile") ||
+             STARTS_WITH(task.get_task_name(), "writeTileAttr")) {
       ranking.push_back(Processor::IO_PROC);
+      ranking.push_back(Processor::LOC_PROC);
     }
     // Other tasks: defer to the default mapping policy
     else {
@@ -553,7 +586,7 @@ public:
     // Read configuration.
     assert(!runtime->is_MPI_interop_configured(ctx));
     assert(EQUALS(task.get_task_name(), "workSingle") ||
-           EQUALS(task.get_task_name(), "workDual"));
+           STARTS_WITH(task.get_task_name(), "workMulti"));
     VariantInfo info =
       default_find_preferred_variant(task, ctx, false/*needs_tight_bound*/);
     CHECK(task.regions.empty() && info.is_replicable,
@@ -637,10 +670,16 @@ public:
                               const Task& task) {
     // Unless handled specially below, all tasks have the same priority.
     int priority = 0;
-    // Assign priorities to sweep tasks such that we prioritize the tile that
-    // has more dependencies downstream (count the number of diagonals between
-    // the launch tile and the end of the domain).
-    if (STARTS_WITH(task.get_task_name(), "sweep_")) {
+    // Assign priorities to sweep tasks according to the length of the chain
+    // of sweeps that depends on them: count the number of diagonals between
+    // the launch tile and the end of the domain (in the direction of the
+    // task's quadrant), and the number of angle blocks of the same quadrant
+    // that follow on the same tile (offset by a constant, since the number of
+    // blocks is not known here). Since this is a count of remaining steps,
+    // sweeps of all quadrants are ranked on the same scale. Sweeps over the
+    // whole grid (angular decomposition) don't feed each other, so they are
+    // left at the default priority.
+    if (STARTS_WITH(task.get_task_name(), "sweep_") && is_tiled(ctx, task)) {
       unsigned sample_id = find_sample_id(ctx, task);
       const SampleMapping& mapping = sample_mappings_[sample_id];
       std::array<bool,3> dir = parse_direction(task);
@@ -649,6 +688,7 @@ public:
         (dir[0] ? mapping.x_tiles() - tile[0] - 1 : tile[0]) +
         (dir[1] ? mapping.y_tiles() - tile[1] - 1 : tile[1]) +
         (dir[2] ? mapping.z_tiles() - tile[2] - 1 : tile[2]) ;
+      priority -= static_cast<int>(parse_angle_block(task));
     }
     // Increase priority of tasks on the critical path of the fluid solve.
     if (STARTS_WITH(task.get_task_name(), "Flow_ComputeVelocityGradient") ||
@@ -667,7 +707,7 @@ public:
                                        const SelectShardingFunctorInput& input,
                                        SelectShardingFunctorOutput& output) {
     CHECK(fill.parent_task != NULL &&
-          (EQUALS(fill.parent_task->get_task_name(), "workDual") ||
+          (STARTS_WITH(fill.parent_task->get_task_name(), "workMulti") ||
            EQUALS(fill.parent_task->get_task_name(), "workSingle")) &&
           !fill.is_index_space &&
           fill.requirement.region.exists() &&
@@ -775,6 +815,32 @@ private:
     return dir;
   }
 
+  unsigned parse_angle_block(const Task& task) const {
+    std::regex regex("\\w*_b([0-9]+)_[1-8]");
+    std::cmatch match;
+    CHECK(std::regex_match(task.get_task_name(), match, regex),
+          "Cannot parse angle block from task name: %s",
+          task.get_task_name());
+    return std::stoul(match[1].str());
+  }
+
+  // Index of the (quadrant, block) group a DOM task belongs to, in the order
+  // used by the DOM module (by block, then by quadrant).
+  unsigned parse_angle_group(const Task& task) const {
+    std::regex regex("\\w*_b([0-9]+)_([1-8])");
+    std::cmatch match;
+    CHECK(std::regex_match(task.get_task_name(), match, regex),
+          "Cannot parse angle group from task name: %s",
+          task.get_task_name());
+    return 8 * std::stoul(match[1].str()) + std::stoul(match[2].str()) - 1;
+  }
+
+  // Whether a task's first region argument is a tile of a partitioned region.
+  bool is_tiled(const MapperContext ctx, const Task& task) const {
+    assert(!task.regions.empty() && task.regions[0].region.exists());
+    return runtime->has_parent_logical_partition(ctx, task.regions[0].region);
+  }
+
   unsigned parse_dimension(const Task& task) const {
     std::regex regex("\\w*_([xyz])_([1-8]|lo|hi)");
     std::cmatch match;
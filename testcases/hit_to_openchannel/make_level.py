@@ -62,10 +62,10 @@ mc['configs'][1]['IO']['probes'][0]['fromCell'][2] = 0
 mc['configs'][1]['IO']['probes'][0]['uptoCell'][0] = args.flow_x
 mc['configs'][1]['IO']['probes'][0]['uptoCell'][1] = args.flow_y - 1
 mc['configs'][1]['IO']['probes'][0]['uptoCell'][2] = args.flow_z - 1
-mc['copySrc']['uptoCell'][1] = args.flow_y - 1
-mc['copySrc']['uptoCell'][2] = args.flow_z - 1
-mc['copyTgt']['uptoCell'][1] = args.flow_y - 1
-mc['copyTgt']['uptoCell'][2] = args.flow_z - 1
+mc['copySrc'][0]['uptoCell'][1] = args.flow_y - 1
+mc['copySrc'][0]['uptoCell'][2] = args.flow_z - 1
+mc['copyTgt'][0]['uptoCell'][1] = args.flow_y - 1
+mc['copyTgt'][0]['uptoCell'][2] = args.flow_z - 1
 
 # Dump final json config
 json.dump(mc, sys.stdout, indent=4)
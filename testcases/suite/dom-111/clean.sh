@@ -1,3 +1,3 @@
 #!/bin/bash -eu
 
-rm -rf intensity.dat test.out
+rm -rf intensity.dat solve_time.dat dom.txt dom_memory.txt dom_phases.txt test.out